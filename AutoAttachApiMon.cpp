@@ -4,6 +4,8 @@
 #include <vector>
 #include <string>
 #include <conio.h>
+#include <chrono>
+#include <future>
 
 #include "ProcessCreatedEventDispatcher.h"
 
@@ -17,26 +19,16 @@ int GetListViewColumnCount(HWND hwndListView);
 std::wstring GetListViewItemText(HWND hwndListView, int itemIndex, int subItemIndex);
 bool WildcardMatch(const std::wstring& str, const std::wstring& pattern);
 bool EnableDebugPrivilege();
+bool ClickContextMenuItem(HWND hwndListView, const std::wstring& matchText);
 void BringWindowToForeground(HWND hWnd);
 // Global variables
 HWND g_hListView = nullptr;
 HWND g_hwndMain = nullptr;
 std::wstring processFilter;
 
-int main()
-{   
-    LPWSTR commandLine = GetCommandLineW();
-    int argc;
-    LPWSTR* argv = CommandLineToArgvW(commandLine, &argc);
-
-    if (argc < 2) {
-        std::cout << "At least one argument is required." << std::endl;
-        return 1; // Exit with error code 1
-    }
-
-    processFilter = std::wstring(argv[1]);
-    LocalFree(argv);
-
+// Locate API Monitor's "Running Processes" ListView, returns exit code (0 on success)
+int DiscoverApiMonitorWindows()
+{
     // needed to monitor when running elevated
     EnableDebugPrivilege();
 
@@ -75,34 +67,78 @@ int main()
         return 1;
     }
 
-    
-
-    // Extract table info
-
-    int columnCount = GetListViewColumnCount(g_hListView);
-
-    if (columnCount == 0)
+    if (GetListViewColumnCount(g_hListView) == 0)
     {
         std::wcout << L"Unable to detect any running processes in API Monitor. If API monitor is running as admin, make sure this is running as admin too." << std::endl;
         return 1;
     }
-    
+
+    return 0;
+}
+
+// Print the full "Running Processes" table, costs one remote round trip per cell
+void PrintRunningProcesses(HWND hwndListView)
+{
+    int columnCount = GetListViewColumnCount(hwndListView);
+
     std::wcout << L"Current running processes in API monitor ...";
 
     std::wcout << L"ColumnCount = " << columnCount << std::endl;
 
-    int rowCount = GetListViewItemCount(g_hListView);
+    int rowCount = GetListViewItemCount(hwndListView);
     std::wcout << L"RowCount = " << rowCount << std::endl;
 
     // Print table content
     for (int i = 0; i < rowCount; ++i) {
         for (int j = 0; j < columnCount; ++j) {
-            std::wcout << GetListViewItemText(g_hListView, i, j) << L"\t";
+            std::wcout << GetListViewItemText(hwndListView, i, j) << L"\t";
         }
         std::wcout << std::endl;
     }
+}
+
+long long ElapsedMilliseconds(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(to - from).count();
+}
+
+int main()
+{   
+    auto startupBegin = std::chrono::steady_clock::now();
+
+    LPWSTR commandLine = GetCommandLineW();
+    int argc;
+    LPWSTR* argv = CommandLineToArgvW(commandLine, &argc);
+
+    if (argc < 2) {
+        std::cout << "At least one argument is required." << std::endl;
+        std::cout << "Usage: AutoAttachApiMon <process wildcard> [--list]" << std::endl;
+        return 1; // Exit with error code 1
+    }
 
+    processFilter = std::wstring(argv[1]);
+
+    // Dumping the running processes table is slow, so only do it when asked
+    bool listRunningProcesses = false;
+    for (int i = 2; i < argc; ++i) {
+        if (_wcsicmp(argv[i], L"--list") == 0) {
+            listRunningProcesses = true;
+        }
+    }
+    LocalFree(argv);
+
+    // Window discovery runs on a worker thread while this thread subscribes to
+    // process creation events, so processes started during startup are not missed
+    std::chrono::steady_clock::time_point discoveryEnd;
+    auto discovery = std::async(std::launch::async, [&discoveryEnd]() {
+        int result = DiscoverApiMonitorWindows();
+        discoveryEnd = std::chrono::steady_clock::now();
+        return result;
+        });
+
+    // Must stay on this thread, it initializes COM here and uninitializes it on destruction
     ProcessCreatedEventDispatcher ProcessCreatedEventDispatcher{};
+    auto subscribeEnd = std::chrono::steady_clock::now();
     ProcessCreatedEventDispatcher.NewProcessCreatedListeners.emplace_back([](auto processName, auto processId) {
         std::wcout << L"Process Name: " << processName << L" Process Id:" << processId << std::endl;
         if (WildcardMatch(processName, processFilter))
@@ -113,6 +149,23 @@ int main()
         std::flush(std::cout);
         });
 
+    int discoveryResult = discovery.get();
+    if (discoveryResult != 0) {
+        return discoveryResult;
+    }
+
+    size_t bufferedEvents = ProcessCreatedEventDispatcher.StartDispatching();
+    auto startupEnd = std::chrono::steady_clock::now();
+
+    std::wcout << L"Startup: window discovery " << ElapsedMilliseconds(startupBegin, discoveryEnd) << L" ms, "
+        << L"WMI subscription " << ElapsedMilliseconds(startupBegin, subscribeEnd) << L" ms, "
+        << L"ready " << ElapsedMilliseconds(startupBegin, startupEnd) << L" ms, "
+        << bufferedEvents << L" buffered event(s) replayed" << std::endl;
+
+    if (listRunningProcesses) {
+        PrintRunningProcesses(g_hListView);
+    }
+
 #ifdef _WIN64
     std::wcout << L"Waiting for 64-bit processes matching '" << processFilter << L"'" << std::endl;
 #else
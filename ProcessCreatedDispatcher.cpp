@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -201,9 +202,7 @@ HRESULT ProcessCreatedEventDispatcher::Indicate(long lObjectCount, IWbemClassObj
                         std::wstring WideProcessName = std::wstring(name.bstrVal);
                         
                         // Pass the process ID, process name, and handle to the listener
-                        for (auto& NewProcessCreatedListener : NewProcessCreatedListeners) {
-                            NewProcessCreatedListener(WideProcessName, WideProcessId);
-                        }
+                        DispatchNewProcessCreated(WideProcessName, WideProcessId);
                     }
                 }
                 VariantClear(&cn);
@@ -218,6 +217,35 @@ HRESULT ProcessCreatedEventDispatcher::Indicate(long lObjectCount, IWbemClassObj
     return WBEM_S_NO_ERROR;
 }
 
+void ProcessCreatedEventDispatcher::DispatchNewProcessCreated(const std::wstring& processName, const std::wstring& processId) {
+    {
+        std::lock_guard<std::mutex> lock(m_dispatchLock);
+        if (!m_dispatching) {
+            m_pendingEvents.emplace_back(processName, processId);
+            return;
+        }
+    }
+
+    for (auto& NewProcessCreatedListener : NewProcessCreatedListeners) {
+        NewProcessCreatedListener(processName, processId);
+    }
+}
+
+size_t ProcessCreatedEventDispatcher::StartDispatching() {
+    // Hold the lock while replaying so events arriving meanwhile are delivered after the buffered ones
+    std::lock_guard<std::mutex> lock(m_dispatchLock);
+    for (auto& PendingEvent : m_pendingEvents) {
+        for (auto& NewProcessCreatedListener : NewProcessCreatedListeners) {
+            NewProcessCreatedListener(PendingEvent.first, PendingEvent.second);
+        }
+    }
+
+    size_t pendingCount = m_pendingEvents.size();
+    m_pendingEvents.clear();
+    m_dispatching = true;
+    return pendingCount;
+}
+
 HRESULT ProcessCreatedEventDispatcher::SetStatus(
     /* [in] */ LONG lFlags,
     /* [in] */ HRESULT hResult,
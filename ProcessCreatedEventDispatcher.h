@@ -1,5 +1,7 @@
 #pragma once
 #include <functional>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include <Wbemidl.h>
@@ -22,8 +24,18 @@ public:
     using NewProcessCreatedListener = void(std::wstring processName, std::wstring processId);
 
     std::vector<std::function<NewProcessCreatedListener>> NewProcessCreatedListeners{};
+
+    // Events received before this is called are buffered rather than dropped, so the
+    // subscription can be started before the listeners are able to act on them.
+    // Replays the buffered events in arrival order and returns how many there were.
+    size_t StartDispatching();
 private:
+    void DispatchNewProcessCreated(const std::wstring& processName, const std::wstring& processId);
+
     LONG m_lRef{};
+    std::mutex m_dispatchLock{};
+    bool m_dispatching{};
+    std::vector<std::pair<std::wstring, std::wstring>> m_pendingEvents{};
     ComPtr<IWbemServices> pSvc{};
     ComPtr<IWbemLocator> pLoc{};
     ComPtr<IUnsecuredApartment> pUnsecApp{};